@@ -185,6 +185,14 @@ void QueryModel<Result>::invalidateData()
   stableIds_.clear();
 }
 
+template <class Result>
+void QueryModel<Result>::hibernate()
+{
+  cacheStart_ = currentRow_ = -1;
+  std::vector<Result>().swap(cache_);
+  AnyList().swap(rowValues_);
+}
+
 template <class Result>
 void QueryModel<Result>::dataReloaded()
 {
@@ -13,6 +13,7 @@
 #include <Wt/Dbo/Field>
 #include <Wt/Dbo/SqlStatement>
 #include <Wt/Dbo/DbAction>
+#include <Wt/Dbo/Session>
 
 #include <Wt/Dbo/Field_impl.h>
 
@@ -121,33 +122,65 @@ QueryBase<Result>::statements(const std::string& where,
 			      const std::string& orderBy,
 			      int limit, int offset) const
 {
-  SqlStatement *statement, *countStatement;
+  Session::QueryKey key;
+  key.resultType = &typeid(Result);
+  key.sql = sql_;
+  key.where = where;
+  key.groupBy = groupBy;
+  key.orderBy = orderBy;
+  key.limit = limit != -1;
+  key.offset = offset != -1;
+
+  Session::QuerySqlCache& cache = this->session_->querySql_;
+  Session::QuerySqlCache::iterator i = cache.find(key);
+
+  if (i == cache.end()) {
+    std::pair<std::string, std::string> sql
+      = createSql(where, groupBy, orderBy, limit, offset);
+
+    if (cache.size() >= Session::MaxQuerySql)
+      cache.clear();
+
+    i = cache.insert(std::make_pair(key, sql)).first;
+  }
+
+  SqlStatement *statement
+    = this->session_->getOrPrepareStatement(i->second.first);
+  SqlStatement *countStatement
+    = this->session_->getOrPrepareStatement(i->second.second);
+
+  return std::make_pair(statement, countStatement);
+}
+
+template <class Result>
+std::pair<std::string, std::string>
+QueryBase<Result>::createSql(const std::string& where,
+			     const std::string& groupBy,
+			     const std::string& orderBy,
+			     int limit, int offset) const
+{
+  std::string sql, countSql;
 
   if (selectFieldLists_.empty()) {
     /*
      * sql_ is "from ..."
      */
-    std::string sql;
-
     std::vector<FieldInfo> fs = this->fields();
     sql = Impl::createQuerySelectSql(sql_, where, groupBy, orderBy,
 				     limit, offset, fs,
 				     this->session_->useRowsFromTo_);
-    statement = this->session_->getOrPrepareStatement(sql);
 
     if (simpleCount_)
-      sql = Impl::createQueryCountSql(sql, sql_, where, groupBy, orderBy,
-				      limit, offset,
-				      this->session_->useRowsFromTo_);
+      countSql = Impl::createQueryCountSql(sql, sql_, where, groupBy, orderBy,
+					   limit, offset,
+					   this->session_->useRowsFromTo_);
     else
-      sql = Impl::createWrappedQueryCountSql(sql);
-
-    countStatement = this->session_->getOrPrepareStatement(sql);
+      countSql = Impl::createWrappedQueryCountSql(sql);
   } else {
     /*
      * sql_ is complete "[with ...] select ..."
      */
-    std::string sql = sql_;
+    sql = sql_;
     int sql_offset = 0;
 
     std::vector<FieldInfo> fs;
@@ -164,20 +197,16 @@ QueryBase<Result>::statements(const std::string& where,
 				       limit, offset, fs,
 				       this->session_->useRowsFromTo_);
 
-    statement = this->session_->getOrPrepareStatement(sql);
-
     if (simpleCount_) {
       std::string from = sql_.substr(selectFieldLists_.front().back().end);
-      sql = Impl::createQueryCountSql(sql, from, where, groupBy, orderBy,
-				      limit, offset,
-				      this->session_->useRowsFromTo_);
+      countSql = Impl::createQueryCountSql(sql, from, where, groupBy, orderBy,
+					   limit, offset,
+					   this->session_->useRowsFromTo_);
     } else
-      sql = Impl::createWrappedQueryCountSql(sql);
-
-    countStatement = this->session_->getOrPrepareStatement(sql);
+      countSql = Impl::createWrappedQueryCountSql(sql);
   }
 
-  return std::make_pair(statement, countStatement);
+  return std::make_pair(sql, countSql);
 }
 
 template <class Result>
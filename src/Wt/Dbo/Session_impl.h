@@ -23,6 +23,24 @@ namespace Wt {
 	{
 	  return session->loadWithNaturalId<C>(statement, column);
 	};
+
+	static void prefetch(Session *session,
+			     const std::vector< ptr<C> >& objects)
+	{ }
+
+	template <class D>
+	static void prefetch(Session *session,
+			     const std::vector< ptr<C> >& objects,
+			     collection< ptr<D> > C::*member)
+	{
+	  session->prefetch(objects);
+	}
+
+	static void addToLoadBatch(Session *session, const T& id)
+	{ }
+
+	static void loadBatch(Session *session, MetaDbo<C>& dbo)
+	{ }
       };
 
       template <class C>
@@ -33,6 +51,30 @@ namespace Wt {
 	{
 	  return session->loadWithLongLongId<C>(statement, column);
 	}
+
+	static void prefetch(Session *session,
+			     const std::vector< ptr<C> >& objects)
+	{
+	  session->prefetchWithLongLongId<C>(objects);
+	}
+
+	template <class D>
+	static void prefetch(Session *session,
+			     const std::vector< ptr<C> >& objects,
+			     collection< ptr<D> > C::*member)
+	{
+	  session->prefetchWithLongLongId<C, D>(objects, member);
+	}
+
+	static void addToLoadBatch(Session *session, long long id)
+	{
+	  session->addToLoadBatch(session->getMapping<C>(), id);
+	}
+
+	static void loadBatch(Session *session, MetaDbo<C>& dbo)
+	{
+	  session->loadBatchWithLongLongId<C>(dbo);
+	}
       };
     }
 
@@ -182,6 +224,167 @@ ptr<C> Session::loadWithLongLongId(SqlStatement *statement, int& column)
     return loadWithNaturalId<C>(statement, column);
 }
 
+template <class C>
+void Session::prefetch(const std::vector< ptr<C> >& objects)
+{
+  Impl::LoadHelper<C, typename dbo_traits<C>::IdType>::prefetch(this, objects);
+}
+
+template <class C, class D>
+void Session::prefetch(const std::vector< ptr<C> >& objects,
+		       ptr<D> C::*member)
+{
+  prefetch(objects);
+
+  std::vector< ptr<D> > related;
+  for (unsigned i = 0; i < objects.size(); ++i)
+    if (objects[i])
+      related.push_back((*objects[i]).*member);
+
+  prefetch(related);
+}
+
+template <class C, class D>
+void Session::prefetch(const std::vector< ptr<C> >& objects,
+		       collection< ptr<D> > C::*member)
+{
+  Impl::LoadHelper<C, typename dbo_traits<C>::IdType>
+    ::prefetch(this, objects, member);
+}
+
+template <class C>
+void Session::prefetchWithLongLongId(const std::vector< ptr<C> >& objects)
+{
+  Mapping<C> *mapping = getMapping<C>();
+
+  if (!mapping->surrogateIdFieldName)
+    return;
+
+  std::set<long long> ids;
+  for (unsigned i = 0; i < objects.size(); ++i) {
+    MetaDbo<C> *dbo = objects[i].obj();
+    if (dbo && !dbo->isLoaded() && dbo->isPersisted() && !dbo->isDeleted())
+      ids.insert(dbo->id());
+  }
+
+  std::string condition
+    = batchCondition(std::string("\"") + mapping->surrogateIdFieldName + "\"");
+
+  for (std::set<long long>::const_iterator i = ids.begin(); i != ids.end();) {
+    Query< ptr<C> > query = find<C>().where(condition);
+
+    /*
+     * The last batch is padded with its last id, so that we always
+     * use the same statement.
+     */
+    long long id = 0;
+    for (int j = 0; j < loadBatchSize_; ++j) {
+      if (i != ids.end())
+	id = *i++;
+      query.bind(id);
+    }
+
+    /*
+     * Loading the results is enough: they are loaded in the objects
+     * that are in the registry.
+     */
+    collection< ptr<C> > results = query.resultList();
+    for (typename collection< ptr<C> >::const_iterator r = results.begin();
+	 r != results.end(); ++r)
+      ;
+  }
+}
+
+template <class C, class D>
+void Session::prefetchWithLongLongId(const std::vector< ptr<C> >& objects,
+				     collection< ptr<D> > C::*member)
+{
+  prefetchWithLongLongId(objects);
+
+  Mapping<C> *mapping = getMapping<C>();
+  Mapping<D> *otherMapping = getMapping<D>();
+
+  typedef std::map<long long, collection< ptr<D> > *> CollectionMap;
+  CollectionMap collections;
+  std::string joinName;
+
+  for (unsigned i = 0; i < objects.size(); ++i) {
+    const ptr<C>& object = objects[i];
+    if (!object || !object.obj()->isPersisted())
+      continue;
+
+    /*
+     * The collection is a cache of the relation, which is not
+     * modified by prefetching it.
+     */
+    collection< ptr<D> >& c
+      = const_cast<collection< ptr<D> >&>((*object).*member);
+    SetInfo *info = c.data_.relation.setInfo;
+
+    if (c.type_ != collection< ptr<D> >::RelationCollection
+	|| !info || info->type != ManyToOne)
+      return;
+
+    joinName = info->joinName;
+    collections[object.id()] = &c;
+  }
+
+  if (collections.empty())
+    return;
+
+  /*
+   * The column of the belongsTo() in D, which must be a single column
+   * since C has a surrogate id.
+   */
+  std::string foreignKey;
+  for (unsigned i = 0; i < otherMapping->fields.size(); ++i) {
+    const FieldInfo& field = otherMapping->fields[i];
+    if (field.isForeignKey()
+	&& field.foreignKeyTable() == mapping->tableName
+	&& field.foreignKeyName() == joinName) {
+      if (!foreignKey.empty())
+	return;
+
+      foreignKey = field.name();
+    }
+  }
+
+  if (foreignKey.empty())
+    return;
+
+  typedef boost::tuple<ptr<D>, long long> Row;
+
+  std::string sql = "select d, d.\"" + foreignKey + "\" from \""
+    + Impl::quoteSchemaDot(otherMapping->tableName) + "\" d";
+  std::string condition = batchCondition("d.\"" + foreignKey + "\"");
+
+  std::map<long long, std::vector< ptr<D> > > results;
+
+  for (typename CollectionMap::const_iterator i = collections.begin();
+       i != collections.end();) {
+    Query<Row> query = this->query<Row>(sql).where(condition);
+
+    long long id = 0;
+    for (int j = 0; j < loadBatchSize_; ++j) {
+      if (i != collections.end())
+	id = (i++)->first;
+      query.bind(id);
+    }
+
+    collection<Row> rows = query.resultList();
+    for (typename collection<Row>::const_iterator r = rows.begin();
+	 r != rows.end(); ++r)
+      results[boost::get<1>(*r)].push_back(boost::get<0>(*r));
+  }
+
+  for (typename CollectionMap::const_iterator i = collections.begin();
+       i != collections.end(); ++i) {
+    collection< ptr<D> > *c = i->second;
+    c->prefetched_ = results[i->first];
+    c->prefetchEpoch_ = prefetchEpoch_;
+  }
+}
+
 template <class C>
 ptr<C> Session::add(ptr<C>& obj)
 {
@@ -228,12 +431,59 @@ ptr<C> Session::loadLazy(const typename dbo_traits<C>::IdType& id)
   Mapping<C> *mapping = getMapping<C>();
   typename Mapping<C>::Registry::iterator i = mapping->registry_.find(id);
 
+  MetaDbo<C> *dbo;
   if (i == mapping->registry_.end()) {
-    MetaDbo<C> *dbo = new MetaDbo<C>(id, -1, MetaDboBase::Persisted, *this, 0);
+    dbo = new MetaDbo<C>(id, -1, MetaDboBase::Persisted, *this, 0);
     mapping->registry_[id] = dbo;
-    return ptr<C>(dbo);
   } else
-    return ptr<C>(i->second);
+    dbo = i->second;
+
+  if (readAheadBatch_ >= 0 && !dbo->isLoaded())
+    Impl::LoadHelper<C, typename dbo_traits<C>::IdType>
+      ::addToLoadBatch(this, id);
+
+  return ptr<C>(dbo);
+}
+
+template <class C>
+void Session::loadBatch(MetaDbo<C>& dbo)
+{
+  if (!loadBatchIds_.empty())
+    Impl::LoadHelper<C, typename dbo_traits<C>::IdType>::loadBatch(this, dbo);
+}
+
+template <class C>
+void Session::loadBatchWithLongLongId(MetaDbo<C>& dbo)
+{
+  Mapping<C> *mapping = getMapping<C>();
+
+  LoadBatchIds::iterator b
+    = loadBatchIds_.find(std::make_pair((MappingInfo *)mapping, dbo.id()));
+  if (b == loadBatchIds_.end())
+    return;
+
+  LoadBatches::iterator batch
+    = loadBatches_.find(std::make_pair((MappingInfo *)mapping, b->second));
+
+  std::vector< ptr<C> > objects;
+  const std::set<long long>& ids = batch->second;
+  for (std::set<long long>::const_iterator i = ids.begin();
+       i != ids.end(); ++i) {
+    loadBatchIds_.erase(std::make_pair((MappingInfo *)mapping, *i));
+
+    typename Mapping<C>::Registry::iterator j = mapping->registry_.find(*i);
+    if (j != mapping->registry_.end())
+      objects.push_back(ptr<C>(j->second));
+  }
+
+  loadBatches_.erase(batch);
+
+  /*
+   * A query would first flush the changes: then only dbo is loaded, by
+   * the caller.
+   */
+  if (transaction_ && dirtyObjects_.empty())
+    prefetchWithLongLongId(objects);
 }
 
 template <class C, typename BindStrategy>
@@ -144,7 +144,10 @@ shared_impl::shared_impl(const collection<C>& collection,
     useCount_(0),
     queryEnded_(false),
     posPastQuery_(0),
-    ended_(false)
+    ended_(false),
+    prefetched_(statement ? 0 : collection.prefetched()),
+    posPrefetched_(0),
+    posReadAhead_(0)
 {
   fetchNextRow();
 }
@@ -170,6 +173,22 @@ void collection<C>::iterator::shared_impl::fetchNextRow()
     return;
   }
 
+  if (prefetched_) {
+    if (posPrefetched_ < prefetched_->size()) {
+      current_ = (*prefetched_)[posPrefetched_++];
+      Impl::Helper<C>::skipIfRemoved(*this);
+      return;
+    }
+
+    prefetched_ = 0;
+  }
+
+  if (posReadAhead_ < readAhead_.size()) {
+    current_ = readAhead_[posReadAhead_++];
+    Impl::Helper<C>::skipIfRemoved(*this);
+    return;
+  }
+
   if (!statement_ || !statement_->nextRow()) {
     queryEnded_ = true;
     if (collection_.manualModeInsertions().size() == 0)
@@ -179,14 +198,57 @@ void collection<C>::iterator::shared_impl::fetchNextRow()
       collection_.iterateDone();
     }
   } else {
-    int column = 0;
-    current_
-      = query_result_traits<C>::load(*collection_.session(), *statement_, column);
+    Session& session = *collection_.session();
+
+    if (session.batchLoading() && session.loadBatchSize() > 1)
+      readAhead(session);
+    else {
+      int column = 0;
+      current_ = query_result_traits<C>::load(session, *statement_, column);
+    }
 
     Impl::Helper<C>::skipIfRemoved(*this);
   }
 }
 
+/*
+ * Loads the current row and up to loadBatchSize() - 1 next rows, so
+ * that the objects which they reference are batch-loaded together.
+ */
+template <class C>
+void collection<C>::iterator::shared_impl::readAhead(Session& session)
+{
+  readAhead_.clear();
+  posReadAhead_ = 0;
+
+  long previousBatch = session.beginReadAhead();
+
+  try {
+    for (;;) {
+      int column = 0;
+      readAhead_.push_back
+	(query_result_traits<C>::load(session, *statement_, column));
+
+      if ((int)readAhead_.size() == session.loadBatchSize())
+	break;
+
+      if (!statement_->nextRow()) {
+	statement_->done();
+	collection_.iterateDone();
+	statement_ = 0;
+	break;
+      }
+    }
+  } catch (...) {
+    session.endReadAhead(previousBatch);
+    throw;
+  }
+
+  session.endReadAhead(previousBatch);
+
+  current_ = readAhead_[posReadAhead_++];
+}
+
 template <class C>
 typename collection<C>::value_type& collection<C>::iterator::shared_impl::current()
 {
@@ -288,7 +350,8 @@ collection<C>::const_iterator::const_iterator(const collection<C>& collection,
 template <class C>
 collection<C>::collection()
   : session_(0),
-    type_(RelationCollection)
+    type_(RelationCollection),
+    prefetchEpoch_(0)
 {
   data_.relation.sql = 0;
   data_.relation.dbo = 0;
@@ -300,7 +363,8 @@ template <class C>
 collection<C>::collection(Session *session, SqlStatement *statement,
 			  SqlStatement *countStatement)
   : session_(session),
-    type_(QueryCollection)
+    type_(QueryCollection),
+    prefetchEpoch_(0)
 {
   data_.query = new QueryData();
   data_.query->useCount = 1;
@@ -313,7 +377,9 @@ template <class C>
 collection<C>::collection(const collection<C>& other)
   : session_(other.session_),
     type_(other.type_),
-    data_(other.data_)
+    data_(other.data_),
+    prefetched_(other.prefetched_),
+    prefetchEpoch_(other.prefetchEpoch_)
 {
   if (type_ == RelationCollection)
     data_.relation.activity = 0;
@@ -346,7 +412,9 @@ collection<C>& collection<C>::operator=(const collection<C>& other)
   session_ = other.session_;
   type_ = other.type_;
   data_ = other.data_;
-  
+  prefetched_ = other.prefetched_;
+  prefetchEpoch_ = other.prefetchEpoch_;
+
   if (type_ == RelationCollection)
     data_.relation.activity = 0;
   else
@@ -381,7 +449,7 @@ SqlStatement *collection<C>::executeStatement() const
 
   if (type_ == QueryCollection)
     statement = data_.query->statement;
-  else {
+  else if (!prefetched()) {
     if (data_.relation.sql) {
       statement = session_->getOrPrepareStatement(*data_.relation.sql);
       int column = 0;
@@ -395,6 +463,16 @@ SqlStatement *collection<C>::executeStatement() const
   return statement;
 }
 
+template <class C>
+const std::vector<C> *collection<C>::prefetched() const
+{
+  if (type_ == RelationCollection && session_ && prefetchEpoch_ != 0
+      && prefetchEpoch_ == session_->prefetchEpoch_)
+    return &prefetched_;
+  else
+    return 0;
+}
+
 template <class C>
 typename collection<C>::iterator collection<C>::begin()
 {
@@ -438,6 +516,9 @@ typename collection<C>::size_type collection<C>::size() const
 
   if (type_ == QueryCollection)
     countStatement = data_.query->countStatement;
+  else if (prefetched())
+    return prefetched_.size()
+      + manualModeInsertions_.size() - manualModeRemovals_.size();
   else {
     if (data_.relation.sql) {
       const std::string *sql = data_.relation.sql;
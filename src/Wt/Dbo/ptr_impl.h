@@ -235,6 +235,11 @@ void MetaDbo<C>::setAutogeneratedId(long long id)
 template <class C>
 void MetaDbo<C>::doLoad()
 {
+  session()->template loadBatch<C>(*this);
+
+  if (obj_)
+    return;
+
   int column = 0;
   session()->template implLoad<C>(*this, 0, column);
   DboHelper<C>::setMeta(*obj_, this);
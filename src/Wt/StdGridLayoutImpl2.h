@@ -47,21 +47,29 @@ protected:
 
 private:
   Impl::Grid& grid_;
-  bool needAdjust_, needRemeasure_, needConfigUpdate_;
+  bool needAdjust_, needRemeasure_, needConfigUpdate_, needMinimumSizeUpdate_;
   std::vector<WLayoutItem *> addedItems_;
   std::vector<std::string> removedItems_;
 
+  // minimum row heights and column widths, -1 if not known
+  mutable std::vector<int> minimumHeights_, minimumWidths_;
+
+  // minimum sizes as last streamed to the client
+  std::vector<int> streamedHeights_, streamedWidths_;
+
   int nextRowWithItem(int row, int c) const;
   int nextColumnWithItem(int row, int col) const;
   bool hasItem(int row, int col) const;
   int minimumHeightForRow(int row) const;
   int minimumWidthForColumn(int column) const;
+  void invalidateMinimumSize(WLayoutItem *item);
   static int pixelSize(const WLength& size);
 
   void streamConfig(WStringStream& js,
 		    const std::vector<Impl::Grid::Section>& sections,
 		    bool rows, WApplication *app);
   void streamConfig(WStringStream& js, WApplication *app);
+  bool streamMinimumSizes(WStringStream& js, bool rows);
   DomElement *createElement(WLayoutItem *item, WApplication *app);
 };
 
@@ -75,6 +75,9 @@ public:
 
   ::int64_t maxMemoryRequestSize() const { return maxMemoryRequestSize_; }
 
+  const std::string& memoryReportPath() const { return memoryReportPath_; }
+  const std::string& memoryReportToken() const { return memoryReportToken_; }
+
   // ssl Password callback is not configurable from a file but we store it
   // here because it's used in the Server constructor (inside start())
   void setSslPasswordCallback(
@@ -120,6 +123,9 @@ private:
 
   ::int64_t maxMemoryRequestSize_;
 
+  std::string memoryReportPath_;
+  std::string memoryReportToken_;
+
   boost::function<std::string (std::size_t max_length, int purpose)> sslPasswordCallback_;
 
   void createOptions(po::options_description& options);
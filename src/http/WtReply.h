@@ -16,6 +16,10 @@
 #include "../web/Configuration.h"
 #include "../web/WebRequest.h"
 
+namespace Wt {
+  class CgiParser;
+}
+
 namespace http {
 namespace server {
 
@@ -74,6 +78,7 @@ protected:
   Wt::WebRequest::WriteCallback fetchMoreDataCallback_;
   Wt::WebRequest::ReadCallback readMessageCallback_;
   HTTPRequest *httpRequest_;
+  Wt::CgiParser *bodyParser_;
 
   char gatherBuf_[16];
 
@@ -85,6 +90,7 @@ protected:
 
 private:
   void readRestWebSocketHandshake();
+  void deleteHttpRequest();
 
   void consumeRequestBody(Buffer::const_iterator begin,
 			  Buffer::const_iterator end,
@@ -1399,6 +1399,20 @@ WT_DECLARE_WT_MEMBER
      layoutDirty = true;
    };
 
+   this.setMinimumSizes = function(rows, cols) {
+     var i, il;
+
+     for (i = 0, il = rows.length; i < il; ++i)
+       config.rows[rows[i][0]][MIN_SIZE] = rows[i][1];
+
+     for (i = 0, il = cols.length; i < il; ++i)
+       config.cols[cols[i][0]][MIN_SIZE] = cols[i][1];
+
+     itemDirty = true;
+
+     APP.layouts2.scheduleAdjust();
+   };
+
    this.setAllDirty = function() {
      var i, il;
      for (i = 0, il = config.items.length; i < il; ++i) {
@@ -1698,6 +1712,12 @@ WT_DECLARE_APP_MEMBER
       return;
     };
 
+    this.updateMinimumSizes = function(id, rows, cols) {
+      var layout = this.find(id);
+      if (layout)
+	layout.setMinimumSizes(rows, cols);
+    };
+
     this.adjustNow = function() {
       if (adjustScheduled)
 	self.adjust();
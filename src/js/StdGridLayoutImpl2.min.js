@@ -21,10 +21,10 @@ p-1]>-1&&k[d+p]>-1)m+=c.margins[0];m+=k[d+p]}}var D;v(h,"visibility","");C=n.ali
 u[0].config.length+a]},setItem:function(a,b,c){A.items[b*u[0].config.length+a]=c},handleClass:"Wt-vrh2",resizeDir:"h",resizerClass:"Wt-hsh2",fitSize:P},{initialized:false,config:A.rows,margins:z,maxSize:F,measures:[],sizes:[],stretched:[],fixedSize:[],Left:"Top",left:"top",Right:"Bottom",Size:"Height",size:"height",alignBits:4,getItem:function(a,b){return A.items[a*u[0].config.length+b]},setItem:function(a,b,c){A.items[a*u[0].config.length+b]=c},handleClass:"Wt-hrh2",resizeDir:"v",resizerClass:"Wt-vsh2",
 fitSize:Q}];jQuery.data(document.getElementById(H),"layout",this);this.updateSizeInParent=function(a){if(U)if(da){var b=u[a],c=b.measures[2];if(b.maxSize>0)c=Math.min(b.maxSize,c);if(fa){b=g.getElement(H);if(!b)return;for(var e=b,i=e.parentNode;;){if(i.wtGetPS)c=i.wtGetPS(i,e,a,c);c+=W(i,a);if(i==O)break;if(a==1&&i==b.parentNode&&!i.lh&&i.offsetHeight>c)c=i.offsetHeight;e=i;i=e.parentNode}}else c+=V[a];U.setChildSize(O,a,c)}};this.setConfig=function(a){var b=A;A=a;u[0].config=A.cols;u[1].config=A.rows;
 u[0].stretched=[];u[1].stretched=[];var c;a=0;for(c=b.items.length;a<c;++a){var e=b.items[a];if(e){if(e.set){e.set[0]&&v(e.w,u[0].size,"");e.set[1]&&v(e.w,u[1].size,"")}if(e.layout){ba.setChildSize(e.w,0,e.ps[0]);ba.setChildSize(e.w,1,e.ps[1])}}}M=Y=true;G.layouts2.scheduleAdjust()};this.getId=function(){return H};this.setElDirty=function(a){var b,c;b=0;for(c=A.items.length;b<c;++b){var e=A.items[b];if(e&&e.id==a.id){e.dirty=2;M=true;G.layouts2.scheduleAdjust();return}}};this.setItemsDirty=function(a){var b,
-c,e=u[0].config.length;b=0;for(c=a.length;b<c;++b){var i=A.items[a[b][0]*e+a[b][1]];i.dirty=2;if(i.layout){i.layout=false;i.wasLayout=true;G.layouts2.setChildLayoutsDirty(ba,i.w)}}M=true};this.setDirty=function(){Y=true};this.setAllDirty=function(){var a,b;a=0;for(b=A.items.length;a<b;++a){var c=A.items[a];if(c)c.dirty=2}M=true};this.setChildSize=function(a,b,c){var e=u[0].config.length,i=u[b],j,k;j=0;for(k=A.items.length;j<k;++j){var t=A.items[j];if(t&&t.id==a.id){a=b===0?j%e:j/e;if(t.align>>i.alignBits&
+c,e=u[0].config.length;b=0;for(c=a.length;b<c;++b){var i=A.items[a[b][0]*e+a[b][1]];i.dirty=2;if(i.layout){i.layout=false;i.wasLayout=true;G.layouts2.setChildLayoutsDirty(ba,i.w)}}M=true};this.setDirty=function(){Y=true};this.setMinimumSizes=function(a,b){var c,e;c=0;for(e=a.length;c<e;++c)A.rows[a[c][0]][2]=a[c][1];c=0;for(e=b.length;c<e;++c)A.cols[b[c][0]][2]=b[c][1];M=true;G.layouts2.scheduleAdjust()};this.setAllDirty=function(){var a,b;a=0;for(b=A.items.length;a<b;++a){var c=A.items[a];if(c)c.dirty=2}M=true};this.setChildSize=function(a,b,c){var e=u[0].config.length,i=u[b],j,k;j=0;for(k=A.items.length;j<k;++j){var t=A.items[j];if(t&&t.id==a.id){a=b===0?j%e:j/e;if(t.align>>i.alignBits&
 15||!i.stretched[a]){if(!t.ps)t.ps=[];t.ps[b]=c}t.layout=true;T(t,1);break}}};this.measure=function(a){var b=g.getElement(H);if(b)if(!g.isHidden(b)){if(!ea){ea=true;ca=I==null;da=true;if(ca){var c=b;c=c.parentNode;for(V=[0,0];c!=document;){V[0]+=W(c,0);V[1]+=W(c,1);if(c.wtGetPS)fa=true;var e=jQuery.data(c.parentNode,"layout");if(e){U=e;O=c;break}c=c;c=c.parentNode;if(c.childNodes.length!=1&&!c.wtGetPS)da=false}c=b.parentNode;for(e=0;e<2;++e)u[e].sizeSet=g.pxself(c,u[e].size)!=0}else{U=jQuery.data(document.getElementById(I),
 "layout");O=b;V[0]=W(O,0);V[1]=W(O,1)}}if(M||Y){c=ca?b.parentNode:null;ga(a,b,c)}if(a==1)M=Y=false}};this.setMaxSize=function(a,b){u[0].maxSize=a;u[1].maxSize=b};this.apply=function(a){var b=g.getElement(H);if(!b)return false;if(g.isHidden(b))return true;la(a,b);return true};this.contains=function(a){var b=g.getElement(H);a=g.getElement(a.getId());return b&&a?g.contains(b,a):false};this.WT=g});
 WT_DECLARE_APP_MEMBER(1,JavaScriptObject,"layouts2",new (function(){var G=[],H=false,I=this,P=false;this.find=function(s){return jQuery.data(document.getElementById(s),"layout")};this.setDirty=function(s){if(s=this.find(s)){s.setDirty();I.scheduleAdjust()}};this.setElementDirty=function(s){var F=s;for(s=s.parentNode;s&&s!=document.body;){var x=jQuery.data(s,"layout");x&&x.setElDirty(F);F=s;s=s.parentNode}};this.setChildLayoutsDirty=function(s,F){var x,z;x=0;for(z=s.descendants.length;x<z;++x){var y=
 s.descendants[x];if(F){var B=s.WT.getElement(y.getId());if(B&&!s.WT.contains(F,B))continue}y.setDirty()}};this.add=function(s){function F(x,z){var y,B;y=0;for(B=x.length;y<B;++y){var w=x[y];if(w.getId()==z.getId()){x[y]=z;z.descendants=w.descendants;return}else if(w.contains(z)){F(w.descendants,z);return}else if(z.contains(w)){z.descendants.push(w);x.splice(y,1);--y;--B}}x.push(z)}F(G,s);I.scheduleAdjust()};var Q=false;this.scheduleAdjust=function(s){if(s)P=true;if(!Q){Q=true;setTimeout(function(){I.adjust()},
-0)}};this.adjust=function(s,F){function x(y,B){var w,K;w=0;for(K=y.length;w<K;++w){var J=y[w];x(J.descendants,B);if(B==1&&P)J.setDirty();else B==0&&J.setAllDirty();J.measure(B)}}function z(y,B){var w,K;w=0;for(K=y.length;w<K;++w){var J=y[w];if(J.apply(B))z(J.descendants,B);else{y.splice(w,1);--w;--K}}}if(s){(s=this.find(s))&&s.setItemsDirty(F);I.scheduleAdjust()}else{Q=false;if(!H){H=true;x(G,0);z(G,0);x(G,1);z(G,1);P=H=false}}};this.updateConfig=function(s,F){(s=this.find(s))&&s.setConfig(F)};this.adjustNow=
+0)}};this.adjust=function(s,F){function x(y,B){var w,K;w=0;for(K=y.length;w<K;++w){var J=y[w];x(J.descendants,B);if(B==1&&P)J.setDirty();else B==0&&J.setAllDirty();J.measure(B)}}function z(y,B){var w,K;w=0;for(K=y.length;w<K;++w){var J=y[w];if(J.apply(B))z(J.descendants,B);else{y.splice(w,1);--w;--K}}}if(s){(s=this.find(s))&&s.setItemsDirty(F);I.scheduleAdjust()}else{Q=false;if(!H){H=true;x(G,0);z(G,0);x(G,1);z(G,1);P=H=false}}};this.updateConfig=function(s,F){(s=this.find(s))&&s.setConfig(F)};this.updateMinimumSizes=function(s,F,x){(s=this.find(s))&&s.setMinimumSizes(F,x)};this.adjustNow=
 function(){Q&&I.adjust()};var S=null;window.onresize=function(){clearTimeout(S);S=setTimeout(function(){S=null;I.scheduleAdjust(true)},20)};window.onshow=function(){P=true;I.adjust()}}));
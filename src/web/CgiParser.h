@@ -31,31 +31,56 @@ public:
   static void init();
 
   CgiParser(::int64_t maxPostData);
+  ~CgiParser();
 
   /*
    * Reads in GET or POST data, converts it to unescaped text, and
    * creates Entry for each parameter entry. The request is annotated
    * with the parse results.
+   *
+   * If the body has already been parsed while it was received (see
+   * startMultipart()), only the query string is parsed.
    */
   void parse(WebRequest& request, ReadOption option);
 
+  /*
+   * Incremental parsing of a multipart/form-data body, for connectors
+   * that receive the body in chunks: startMultipart() is called before
+   * the first chunk, feed() for every chunk and finishMultipart() at the
+   * end. Parameters and files are added to the request as they are
+   * parsed, and file parts are written directly to their spool file.
+   *
+   * When the body exceeds the maximum post data, it is discarded
+   * instead.
+   *
+   * Throws a WException when the body is malformed.
+   */
+  void startMultipart(WebRequest& request);
+  void feed(const char *data, std::size_t length);
+  void finishMultipart();
+
 private:
-  void readMultipartData(WebRequest& request, const std::string type,
-			 ::int64_t len);
-  bool parseBody(WebRequest& request, const std::string boundary);
-  bool parseHead(WebRequest& request);
-  ::int64_t maxPostData_, left_;
-  std::ostream *spoolStream_;
+  enum State { Preamble, Boundary, Head, Body, Epilogue, Discard };
+
+  ::int64_t maxPostData_;
   WebRequest *request_;
 
+  State state_;
+  std::string boundary_;
+  std::string head_;
+  std::string value_;
   std::string currentKey_;
+  std::ostream *spoolStream_;
 
-  void readUntilBoundary(WebRequest& request, const std::string boundary,
-			 int tossAtBoundary,
-			 std::string *resultString,
-			 std::ostream *resultFile);
+  void readMultipartData(WebRequest& request, const std::string type,
+			 ::int64_t len);
+  void setBoundary(const std::string& type);
+  void process();
+  void parseHead();
+  void partDone();
+  void save(int length);
   void windBuffer(int offset);
-  int index(const std::string search);
+  int index(const std::string& search) const;
 
   enum {BUFSIZE = 8192};
   enum {MAXBOUND = 100};
@@ -128,6 +128,7 @@ public:
   bool reloadIsNewSession() const;
   int sessionTimeout() const;
   int bootstrapTimeout() const;
+  int hibernationTimeout() const;
   int indicatorTimeout() const;
   int doubleClickTimeout() const;
   int serverPushTimeout() const;
@@ -151,6 +152,7 @@ public:
   bool serializedEvents() const;
   bool webSockets() const;
   bool inlineCss() const;
+  std::string javaScriptModulesPath() const;
   bool persistentSessions() const;
   bool progressiveBoot() const;
   bool splitScript() const;
@@ -203,6 +205,7 @@ private:
   bool            reloadIsNewSession_;
   int             sessionTimeout_;
   int             bootstrapTimeout_;
+  int             hibernationTimeout_;
   int		  indicatorTimeout_;
   int             doubleClickTimeout_;
   int             serverPushTimeout_;
@@ -217,6 +220,7 @@ private:
   bool            serializedEvents_;
   bool		  webSockets_;
   bool            inlineCss_;
+  std::string     javaScriptModulesPath_;
   AgentList       ajaxAgentList_, botList_;
   bool            ajaxAgentWhiteList_;
   bool            persistentSessions_;
@@ -0,0 +1,70 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2014 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_COROUTINE_H_
+#define WT_COROUTINE_H_
+
+#include <Wt/WDllDefs.h>
+
+#ifdef WT_USE_BOOST_CONTEXT
+
+#include <exception>
+
+#include <boost/context/continuation.hpp>
+#include <boost/function.hpp>
+
+namespace Wt {
+
+/*
+ * A stackful coroutine, used to run the handling of a request so that
+ * a recursive event loop (WDialog::exec()) can park its stack instead
+ * of blocking the thread.
+ *
+ * A coroutine runs its function from the first resume() until the
+ * function calls suspend(), after which resume() returns. A later
+ * resume() continues the function where it left off, possibly from
+ * another thread. An exception thrown by the function is rethrown by
+ * resume().
+ */
+class Coroutine
+{
+public:
+  Coroutine(const boost::function<void ()>& function);
+
+  /*
+   * Runs the coroutine until it suspends or finishes.
+   */
+  void resume();
+
+  bool finished() const { return finished_; }
+
+  /*
+   * Suspends the current coroutine: resume() returns to its caller.
+   */
+  static void suspend();
+
+  /*
+   * Returns the coroutine running in this thread, or 0.
+   */
+  static Coroutine *current();
+
+private:
+  boost::function<void ()> function_;
+  boost::context::continuation context_, caller_;
+  std::exception_ptr exception_;
+  bool started_, finished_;
+
+  Coroutine(const Coroutine&);
+  Coroutine& operator=(const Coroutine&);
+
+  boost::context::continuation run(boost::context::continuation&& caller);
+};
+
+}
+
+#endif // WT_USE_BOOST_CONTEXT
+
+#endif // WT_COROUTINE_H_
@@ -0,0 +1,61 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2014 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef JAVASCRIPT_MODULES_H_
+#define JAVASCRIPT_MODULES_H_
+
+#include <map>
+#include <string>
+
+#include <Wt/WResource>
+
+#ifdef WT_THREADED
+#include <boost/thread.hpp>
+#endif // WT_THREADED
+
+namespace Wt {
+
+/*
+ * Serves JavaScript that is the same for all sessions (the preambles
+ * of widgets) as static modules, which are named by a hash of their
+ * contents and thus cacheable forever.
+ *
+ * Modules are registered by sessions when they are first needed, and
+ * kept for the lifetime of the process. Their number is bounded: the
+ * combinations of preambles that are needed together are determined
+ * by the application code.
+ */
+class JavaScriptModules : public WResource
+{
+public:
+  JavaScriptModules();
+  virtual ~JavaScriptModules();
+
+  /*
+   * Registers a module, and returns its path relative to the
+   * resource, or an empty string if the module could not be added (in
+   * which case it should be served inline).
+   */
+  std::string add(const std::string& js);
+
+  virtual void handleRequest(const Http::Request& request,
+			     Http::Response& response);
+
+private:
+  static const std::size_t MAX_MODULES = 1000;
+
+  typedef std::map<std::string, std::string> ModuleMap;
+
+#ifdef WT_THREADED
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  ModuleMap modules_;
+};
+
+}
+
+#endif // JAVASCRIPT_MODULES_H_
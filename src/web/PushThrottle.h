@@ -0,0 +1,55 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2014 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef PUSH_THROTTLE_H_
+#define PUSH_THROTTLE_H_
+
+#include <Wt/WDllDefs.h>
+
+#include "TimeUtil.h"
+
+namespace Wt {
+
+/*
+ * Decides when a server push update is sent, so that the updates that
+ * are triggered within the update interval of an application (see
+ * WApplication::setUpdateInterval()) are merged into a single update.
+ */
+class WT_API PushThrottle
+{
+public:
+  PushThrottle();
+
+  /*
+   * Returns how long (in ms) an update that is triggered at 'now'
+   * should wait before it is pushed: 0 if it should be pushed right
+   * away, or -1 if it is merged with an update that is already
+   * scheduled. When a positive value is returned, the caller should
+   * schedule the push.
+   */
+  int schedule(int interval, const Time& now);
+
+  /*
+   * Records that an update was pushed at 'now'.
+   */
+  void pushed(const Time& now);
+
+  /*
+   * Forgets about the scheduled update, because it is no longer
+   * needed (the changes were sent otherwise) or because it is due.
+   */
+  void cancel();
+
+  bool isScheduled() const { return scheduled_; }
+
+private:
+  bool scheduled_, pushedBefore_;
+  Time lastPush_, due_;
+};
+
+}
+
+#endif // PUSH_THROTTLE_H_
@@ -0,0 +1,89 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2014 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef STATELESS_SLOT_CACHE_H_
+#define STATELESS_SLOT_CACHE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Wt/WDllDefs.h>
+
+#ifdef WT_THREADED
+#include <boost/thread.hpp>
+#endif // WT_THREADED
+
+namespace Wt {
+
+/*
+ * A process-wide cache of the JavaScript learned for pre-learned
+ * stateless slots, which lets sessions skip learning the same slot of
+ * identical widgets.
+ *
+ * The JavaScript is stored with the id of the widget abstracted out,
+ * under a key that describes the widget class, the slot and the state
+ * the result depends on (see WebRenderer::statelessSlotKey()).
+ *
+ * An entry is only used after its result was confirmed by learning it
+ * for other widgets, and is discarded for good when a widget learned
+ * something else: the JavaScript then depended on more than the key
+ * (e.g. on other widgets).
+ */
+class WT_API StatelessSlotCache
+{
+public:
+  StatelessSlotCache();
+
+  /*
+   * Returns whether a confirmed entry exists for the key, and if so
+   * sets js to its JavaScript for the widget with the given id.
+   */
+  bool find(const std::string& key, const std::string& id, std::string& js);
+
+  /*
+   * Records the JavaScript learned for the widget with the given id.
+   */
+  void learned(const std::string& key, const std::string& id,
+	       const std::string& js);
+
+  // Number of slots for which learning was avoided
+  long long hits() const;
+
+  // Number of slots that were learned
+  long long misses() const;
+
+private:
+  static const int CONFIRMATIONS = 2;
+  static const std::size_t MAX_ENTRIES = 10000;
+
+  struct Entry {
+    Entry();
+
+    // the JavaScript, split at the occurrences of the widget id
+    std::vector<std::string> parts;
+    int confirmations;
+    bool disabled;
+  };
+
+  typedef std::map<std::string, Entry> EntryMap;
+
+#ifdef WT_THREADED
+  mutable boost::mutex mutex_;
+#endif // WT_THREADED
+
+  EntryMap entries_;
+  long long hits_, misses_;
+
+  static std::vector<std::string> split(const std::string& js,
+					const std::string& id);
+  static std::string join(const std::vector<std::string>& parts,
+			  const std::string& id);
+};
+
+}
+
+#endif // STATELESS_SLOT_CACHE_H_
@@ -13,6 +13,7 @@
 #include <map>
 
 #include <Wt/WDllDefs.h>
+#include <Wt/WIOService>
 #include <Wt/WServer>
 #include <Wt/WSocketNotifier>
 
@@ -26,6 +27,8 @@ namespace Wt {
 
 class Configuration;
 class EntryPoint;
+class JavaScriptModules;
+class StatelessSlotCache;
 
 class WebRequest;
 class WebSession;
@@ -87,6 +90,11 @@ public:
   std::string computeRedirectHash(const std::string& url);
 
 #ifndef WT_TARGET_JAVA
+  // Returns 0 if the JavaScript of widgets is served inline
+  JavaScriptModules *javaScriptModules() const { return javaScriptModules_; }
+
+  StatelessSlotCache& statelessSlotCache() { return *statelessSlotCache_; }
+
   WebController(WServer& server,
 		const std::string& singleSessionId = std::string(),
 		bool autoExpire = true);
@@ -94,6 +102,9 @@ public:
 
   int sessionCount() const;
 
+  // Takes every session's lock in turn
+  void memoryUsage(std::vector<WMemoryUsage>& result);
+
   // Returns whether we should continue receiving data.
   bool requestDataReceived(WebRequest *request, boost::uintmax_t current,
 			   boost::uintmax_t total);
@@ -102,8 +113,20 @@ public:
 
 #ifndef WT_CNOR
   bool handleApplicationEvent(const ApplicationEvent& event);
+
+  void subscribe(const std::string& sessionId, const std::string& topic);
+  void unsubscribe(const std::string& sessionId, const std::string& topic);
+  void publish(const std::string& topic,
+	       const boost::function<void ()>& function);
+
+  // Returns the number of subscriptions of all sessions to all topics
+  int subscriptionCount();
 #endif // WT_CNOR
 
+  // Accumulates the server push statistics of a session that ends
+  void addPushStatistics(long long updatesTriggered, long long updatesPushed,
+			 long long bytesPushed);
+
   bool expireSessions();
   void start();
   void shutdown();
@@ -134,15 +157,41 @@ private:
   int plainHtmlSessions_, ajaxSessions_;
   std::string redirectSecret_;
   bool running_;
+  WIOService::TimerId expireTimer_;
+  JavaScriptModules *javaScriptModules_;
+  StatelessSlotCache *statelessSlotCache_;
 
 #ifdef WT_THREADED
   boost::mutex uploadProgressUrlsMutex_;
 #endif // WT_THREADED
   std::set<std::string> uploadProgressUrls_;
 
+#ifdef WT_THREADED
+  boost::mutex pushStatisticsMutex_;
+#endif // WT_THREADED
+  long long updatesTriggered_, updatesPushed_, bytesPushed_;
+
   typedef std::map<std::string, boost::shared_ptr<WebSession> > SessionMap;
   SessionMap sessions_;
 
+  /*
+   * Subscribers of a topic are not kept alive by their subscription.
+   * Their subscriptions are removed when they are removed from the
+   * sessions map, and when they are found dead while publishing.
+   */
+  typedef std::map<WebSession *, boost::weak_ptr<WebSession> > Subscribers;
+  typedef std::map<std::string, Subscribers> TopicMap;
+  TopicMap topics_;
+
+  // the topics of every subscriber
+  typedef std::map<WebSession *, std::set<std::string> > SubscriberTopics;
+  SubscriberTopics subscriberTopics_;
+
+#ifdef WT_THREADED
+  // mutex to protect access to the topics map
+  boost::mutex topicsMutex_;
+#endif // WT_THREADED
+
 #ifdef WT_THREADED
   // mutex to protect access to the sessions map and plain/ajax session
   // counts
@@ -161,9 +210,27 @@ private:
   void socketNotify(int descriptor, WSocketNotifier::Type type);
 #endif
 
+  void expireTimeout();
+
+#ifndef WT_CNOR
+  typedef std::vector<boost::weak_ptr<WebSession> > SessionList;
+
+  bool handleApplicationEvent(const boost::shared_ptr<WebSession>& session,
+			      const ApplicationEvent& event);
+  void processApplicationEvent(boost::shared_ptr<WebSession> session,
+			       ApplicationEvent event, bool *handled);
+  void handleTopicEvent(const boost::shared_ptr<SessionList>& sessions,
+			const boost::function<void ()>& function);
+#endif // WT_CNOR
+
+  void removeSubscriptions(WebSession *session);
+
   void updateResourceProgress(WebRequest *request,
 			      boost::uintmax_t current, boost::uintmax_t total);
 
+  void handleSessionRequest(boost::shared_ptr<WebSession> session,
+			    std::string sessionId, WebRequest *request);
+
   const EntryPoint *getEntryPoint(WebRequest *request);
 
   static std::string appSessionCookie(std::string url);
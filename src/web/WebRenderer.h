@@ -59,6 +59,8 @@ public:
 
   bool isDirty() const;
   int scriptId() const { return scriptId_; }
+  // length of the JavaScript of the last update
+  std::size_t updateLength() const { return updateLength_; }
   int pageId() const { return pageId_; }
 
   void serveResponse(WebResponse& request);
@@ -106,6 +108,7 @@ private:
   std::string currentFormObjectsList_;
   bool formObjectsChanged_;
   bool updateLayout_;
+  std::size_t updateLength_;
 
   void setHeaders(WebResponse& request, const std::string mimeType);
   void setCaching(WebResponse& response, bool allowCache);
@@ -126,6 +129,8 @@ private:
   void loadStyleSheets(WStringStream& out, WApplication *app);
   int loadScriptLibraries(WStringStream& out, WApplication *app,
 			  int count = -1);
+  int loadJavaScriptModules(WStringStream& out, WApplication *app, bool all,
+			    int count = -1);
   void updateLoadIndicator(WStringStream& out, WApplication *app, bool all);
   void renderSetServerPush(WStringStream& out);
   void setJSSynced(bool invisibleToo);
@@ -155,6 +160,7 @@ private:
   bool learning_, learningIncomplete_, moreUpdates_;
 
   std::string safeJsStringLiteral(const std::string& value);
+  std::string statelessSlotKey(WStatelessSlot *slot);
 
 public:
   std::string       learn(WStatelessSlot* slot);
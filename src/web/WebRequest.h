@@ -213,6 +213,7 @@ private:
   Http::UploadedFileMap files_;
   ResponseType responseType_;
   bool webSocketRequest_;
+  bool bodyParsed_;
   boost::posix_time::ptime start_;
 
   static Http::ParameterValues emptyValues_;
@@ -22,6 +22,7 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/enable_shared_from_this.hpp>
 
+#include "PushThrottle.h"
 #include "TimeUtil.h"
 #include "WebRenderer.h"
 #include "WebRequest.h"
@@ -32,6 +33,7 @@
 
 namespace Wt {
 
+class Coroutine;
 class WebController;
 class WebRequest;
 class WebResponse;
@@ -106,6 +108,13 @@ public:
   void expire();
   bool unlockRecursiveEventLoop();
 
+  /*
+   * Runs a function that takes a session lock on a coroutine, so that
+   * a recursive event loop in it parks its stack instead of blocking
+   * the thread. Without coroutine support, simply runs the function.
+   */
+  static void runOnCoroutine(const boost::function<void ()>& function);
+
   void pushEmitStack(WObject *obj);
   void popEmitStack();
   WObject *emitStackTop();
@@ -113,6 +122,11 @@ public:
 #ifndef WT_TARGET_JAVA
   const Time& expireTime() const { return expire_; }
   bool shouldDisconnect() const;
+
+  // Time of the last user event (keep-alives and polls excluded)
+  const Time& activityTime() const { return activity_; }
+  bool isHibernated() const { return hibernated_; }
+  void hibernateIdle();
 #endif // WT_TARGET_JAVA
 
   bool dead() { return state_ == Dead; }
@@ -247,7 +261,11 @@ private:
   void handleWebSocketRequest(Handler& handler);
   static void handleWebSocketMessage(boost::weak_ptr<WebSession> session,
 				     WebRequest::ReadEvent event);
+  static void processWebSocketMessage(boost::weak_ptr<WebSession> session,
+				      WebRequest::ReadEvent event);
   static void webSocketReady(boost::weak_ptr<WebSession> session);
+  static void pushTimeout(boost::weak_ptr<WebSession> session);
+  void cancelPushTimeout();
 
   void checkTimers();
   void hibernate();
@@ -286,6 +304,8 @@ private:
 
 #ifndef WT_TARGET_JAVA
   Time             expire_;
+  Time             activity_;
+  bool             hibernated_;
 #endif
 
 #ifdef WT_BOOST_THREADS
@@ -299,6 +319,13 @@ private:
 #endif
   bool             updatesPending_, triggerUpdate_;
 
+  /* Coalescing of server push updates */
+#ifndef WT_TARGET_JAVA
+  PushThrottle     pushThrottle_;
+  boost::uint64_t  pushTimer_; // the WIOService::TimerId, or 0
+#endif // WT_TARGET_JAVA
+  long long        updatesTriggered_, updatesPushed_, bytesPushed_;
+
   WEnvironment  embeddedEnv_;
   WEnvironment *env_;
   WApplication *app_;
@@ -309,6 +336,10 @@ private:
 
   Handler *recursiveEventLoop_;
 
+  // the coroutine of the recursive event loop, while it is parked
+  Coroutine *parkedEventLoop_;
+  static void resumeCoroutine(Coroutine *coroutine);
+
   WResource *decodeResource(const std::string& resourceId);
   EventSignalBase *decodeSignal(const std::string& signalId,
 				bool checkExposed) const;
@@ -0,0 +1,55 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2014 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef BENCHMARK_TIMER_H_
+#define BENCHMARK_TIMER_H_
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <iostream>
+#include <string>
+
+/*
+ * Times the steps of a benchmark (see the 'benchmark' target), and
+ * reports them on std::cerr, one line per step:
+ *
+ *   BenchmarkTimer timer;
+ *   ... step ...
+ *   timer.report("step");
+ */
+class BenchmarkTimer
+{
+public:
+  BenchmarkTimer() {
+    restart();
+  }
+
+  void restart() {
+    start_ = boost::posix_time::microsec_clock::local_time();
+  }
+
+  // milliseconds since the (re)start
+  long elapsed() const {
+    return (boost::posix_time::microsec_clock::local_time() - start_)
+      .total_milliseconds();
+  }
+
+  // reports the time of a step, and restarts for the next one
+  void report(const std::string& step,
+	      const std::string& details = std::string()) {
+    std::cerr << "[benchmark] " << step << ": " << elapsed() << " ms";
+    if (!details.empty())
+      std::cerr << ", " << details;
+    std::cerr << std::endl;
+
+    restart();
+  }
+
+private:
+  boost::posix_time::ptime start_;
+};
+
+#endif // BENCHMARK_TIMER_H_
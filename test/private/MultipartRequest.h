@@ -0,0 +1,148 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2014 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef MULTIPART_REQUEST_H_
+#define MULTIPART_REQUEST_H_
+
+#include <boost/test/unit_test.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "web/CgiParser.h"
+#include "web/WebRequest.h"
+#include "Wt/Http/Request"
+
+#include <fstream>
+#include <sstream>
+
+/*
+ * A multipart/form-data upload request, shared by the CgiParser test
+ * and benchmark.
+ */
+namespace {
+  const std::string BOUNDARY = "----WtUploadBoundary7MA4YWxkTrZu0gW";
+
+  class TestRequest : public Wt::WebResponse
+  {
+  public:
+    TestRequest(const std::string& body)
+      : in_(body),
+	contentLength_(boost::lexical_cast<std::string>(body.length()))
+    { }
+
+    virtual ~TestRequest() { }
+
+    virtual void flush(ResponseState state, const WriteCallback& callback)
+    { }
+
+    virtual std::istream& in() { return in_; }
+    virtual std::ostream& out() { return out_; }
+    virtual std::ostream& err() { return out_; }
+
+    virtual void setRedirect(const std::string& url) { }
+    virtual void setStatus(int status) { }
+    virtual void setContentType(const std::string& value) { }
+    virtual void setContentLength(::int64_t length) { }
+    virtual void addHeader(const std::string& name,
+			   const std::string& value) { }
+
+    virtual std::string envValue(const std::string& name) const {
+      if (name == "CONTENT_TYPE")
+	return "multipart/form-data; boundary=" + BOUNDARY;
+      else if (name == "CONTENT_LENGTH")
+	return contentLength_;
+      else
+	return std::string();
+    }
+
+    virtual std::string serverName() const { return "localhost"; }
+    virtual std::string serverPort() const { return "80"; }
+    virtual std::string scriptName() const { return "/"; }
+    virtual std::string requestMethod() const { return "POST"; }
+    virtual std::string queryString() const { return "wtd=abc"; }
+    virtual std::string pathInfo() const { return std::string(); }
+    virtual std::string remoteAddr() const { return "127.0.0.1"; }
+    virtual std::string urlScheme() const { return "http"; }
+
+    virtual std::string headerValue(const std::string& name) const {
+      return std::string();
+    }
+
+    virtual Wt::WSslInfo *sslInfo() const { return 0; }
+
+  private:
+    std::istringstream in_;
+    std::ostringstream out_;
+    std::string contentLength_;
+  };
+
+  /*
+   * Binary content, with plenty of characters that also start a
+   * boundary.
+   */
+  inline std::string fileContents(std::size_t size)
+  {
+    std::string result(size, 0);
+
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = (i % 97 == 0) ? '\r' : (i % 89 == 0) ? '-'
+	: static_cast<char>(i * 31);
+
+    return result;
+  }
+
+  inline std::string createBody(const std::string& contents)
+  {
+    std::string result;
+
+    result += "--" + BOUNDARY + "\r\n"
+      "Content-Disposition: form-data; name=\"title\"\r\n\r\n"
+      "An upload\r\n";
+
+    result += "--" + BOUNDARY + "\r\n"
+      "Content-Disposition: form-data; name=\"data\"; filename=\"a.bin\"\r\n"
+      "Content-Type: application/octet-stream\r\n\r\n";
+    result += contents;
+    result += "\r\n";
+
+    result += "--" + BOUNDARY + "\r\n"
+      "Content-Disposition: form-data; name=\"empty\"\r\n\r\n"
+      "\r\n";
+
+    result += "--" + BOUNDARY + "--\r\n";
+
+    return result;
+  }
+
+  inline std::string readFile(const std::string& fileName)
+  {
+    std::ifstream f(fileName.c_str(), std::ios::in | std::ios::binary);
+    std::stringstream result;
+    result << f.rdbuf();
+    return result.str();
+  }
+
+  inline void checkResult(const Wt::WebRequest& request,
+			  const std::string& contents)
+  {
+    const std::string *title = request.getParameter("title");
+    BOOST_REQUIRE(title && *title == "An upload");
+
+    const std::string *empty = request.getParameter("empty");
+    BOOST_REQUIRE(empty && empty->empty());
+
+    const std::string *wtd = request.getParameter("wtd");
+    BOOST_REQUIRE(wtd && *wtd == "abc");
+
+    Wt::Http::UploadedFileMap::const_iterator i
+      = request.uploadedFiles().find("data");
+    BOOST_REQUIRE(i != request.uploadedFiles().end());
+    BOOST_REQUIRE(i->second.clientFileName() == "a.bin");
+    BOOST_REQUIRE(i->second.contentType() == "application/octet-stream");
+    BOOST_REQUIRE(readFile(i->second.spoolFileName()) == contents);
+  }
+}
+
+#endif // MULTIPART_REQUEST_H_
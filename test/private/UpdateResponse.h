@@ -0,0 +1,99 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2014 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef UPDATE_RESPONSE_H_
+#define UPDATE_RESPONSE_H_
+
+#include "Wt/WApplication"
+
+#include "web/WebRenderer.h"
+#include "web/WebRequest.h"
+#include "web/WebSession.h"
+
+#include <cstdlib>
+#include <sstream>
+
+/*
+ * Renders the incremental updates of a test session, as the response
+ * to an Ajax request, shared by the tests that inspect the JavaScript
+ * sent to the browser.
+ */
+namespace {
+  class UpdateResponse : public Wt::WebResponse
+  {
+  public:
+    UpdateResponse() {
+      setResponseType(Update);
+    }
+
+    virtual void flush(ResponseState state, const WriteCallback& callback)
+    { }
+
+    virtual std::istream& in() { return in_; }
+    virtual std::ostream& out() { return out_; }
+    virtual std::ostream& err() { return out_; }
+
+    virtual void setRedirect(const std::string& url) { }
+    virtual void setStatus(int status) { }
+    virtual void setContentType(const std::string& value) { }
+    virtual void setContentLength(::int64_t length) { }
+    virtual void addHeader(const std::string& name,
+			   const std::string& value) { }
+
+    virtual std::string envValue(const std::string& name) const {
+      return std::string();
+    }
+
+    virtual std::string serverName() const { return "localhost"; }
+    virtual std::string serverPort() const { return "80"; }
+    virtual std::string scriptName() const { return "/"; }
+    virtual std::string requestMethod() const { return "POST"; }
+    virtual std::string queryString() const { return std::string(); }
+    virtual std::string pathInfo() const { return std::string(); }
+    virtual std::string remoteAddr() const { return "127.0.0.1"; }
+    virtual std::string urlScheme() const { return "http"; }
+
+    virtual std::string headerValue(const std::string& name) const {
+      return std::string();
+    }
+
+    virtual Wt::WSslInfo *sslInfo() const { return 0; }
+
+    std::string js() const { return out_.str(); }
+
+  private:
+    std::istringstream in_;
+    std::ostringstream out_;
+  };
+
+  inline std::string renderUpdate(Wt::WApplication& app)
+  {
+    Wt::WebRenderer& renderer = app.session()->renderer();
+
+    UpdateResponse response;
+    renderer.serveResponse(response);
+    std::string js = response.js();
+
+    // acknowledge the update, like the next request of the browser does
+    const std::string ack = "._p_.response(";
+    std::size_t i = js.find(ack);
+    if (i != std::string::npos)
+      renderer.ackUpdate(std::atoi(js.c_str() + i + ack.length()));
+
+    return js;
+  }
+
+  inline int count(const std::string& s, const std::string& what)
+  {
+    int result = 0;
+    for (std::size_t i = s.find(what); i != std::string::npos;
+	 i = s.find(what, i + what.length()))
+      ++result;
+    return result;
+  }
+}
+
+#endif // UPDATE_RESPONSE_H_